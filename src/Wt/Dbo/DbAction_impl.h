@@ -8,6 +8,7 @@
 #define WT_DBO_DBACTION_IMPL_H_
 
 #include <Wt/Dbo/Exception>
+#include <Wt/Dbo/ObjectCache>
 #include <iostream>
 #include <boost/lexical_cast.hpp>
 
@@ -282,6 +283,25 @@ void LoadDbAction<C>::visit(C& obj)
   bool continueStatement = statement_ != 0;
   Session *session = dbo_.session();
 
+  ObjectCache *cache = continueStatement ? 0 : session->cacheFor(mapping());
+  Impl::CachedRow row;
+  std::string cacheId;
+  bool cached = false;
+
+  if (cache) {
+    cacheId = boost::lexical_cast<std::string>(dbo_.id());
+
+    if (cache->lookup(mapping().tableName, cacheId, row, cached)) {
+      statement_ = &row;
+
+      start();
+      persist<C>::apply(obj, *this);
+
+      statement_ = 0;
+      return;
+    }
+  }
+
   if (!continueStatement) {
     use(statement_ = session->template getStatement<C>(Session::SqlSelectById));
     statement_->reset();
@@ -297,14 +317,26 @@ void LoadDbAction<C>::visit(C& obj)
     }
   }
 
+  SqlStatement *statement = statement_;
+
+  if (cached) {
+    row.record(statement);
+    statement_ = &row;
+  }
+
   start();
 
   persist<C>::apply(obj, *this);
 
+  statement_ = statement;
+
   if (!continueStatement && statement_->nextRow())
     throw Exception("Dbo load: multiple rows for id "
 		    + boost::lexical_cast<std::string>(dbo_.id()) + " ??");
 
+  if (cached)
+    cache->store(mapping().tableName, cacheId, row, session->cacheEpoch());
+
   if (continueStatement)
     use(0);
 }
@@ -520,6 +552,41 @@ void SaveDbAction<C>::visit(C& obj)
   }
 }
 
+template<class C>
+void SaveDbAction<C>::visitDependencies(C& obj)
+{
+  startDependencyPass();
+
+  persist<C>::apply(obj, *this);
+}
+
+template<class C>
+bool SaveDbAction<C>::bindInsert(C& obj, SqlStatement *statement, int& column)
+{
+  statement_ = statement;
+  isInsert_ = true;
+
+  pass_ = Self;
+  needSetsPass_ = false;
+  column_ = column;
+
+  if (mapping().versionFieldName)
+    statement_->bind(column_++, dbo_.version() + 1);
+
+  persist<C>::apply(obj, *this);
+
+  column = column_;
+
+  return needSetsPass_;
+}
+
+template<class C>
+void SaveDbAction<C>::visitSets(C& obj)
+{
+  startSetsPass();
+  persist<C>::apply(obj, *this);
+}
+
 template<class C>
 template<typename V>
 void SaveDbAction<C>::actId(V& value, const std::string& name, int size)
@@ -9,16 +9,91 @@
 
 #include <Wt/Dbo/QueryColumn>
 
+#include <algorithm>
+
 namespace Wt {
   namespace Dbo {
+    namespace Impl {
+
+template <typename T, class Result>
+bool bindSeekValueAs(Query<Result> *query, const boost::any& value)
+{
+  if (value.type() != typeid(T))
+    return false;
+
+  if (query)
+    query->bind(boost::any_cast<T>(value));
+
+  return true;
+}
+
+/*
+ * Binds a sort key value to the query, or only checks whether this
+ * is possible when query = 0. Values of other types (such as
+ * boost::optional<T>, which could be null) cannot be used for a seek.
+ */
+template <class Result>
+bool bindSeekValue(Query<Result> *query, const boost::any& value)
+{
+  return bindSeekValueAs<int>(query, value)
+    || bindSeekValueAs<long long>(query, value)
+    || bindSeekValueAs<long>(query, value)
+    || bindSeekValueAs<short>(query, value)
+    || bindSeekValueAs<double>(query, value)
+    || bindSeekValueAs<float>(query, value)
+    || bindSeekValueAs<std::string>(query, value)
+    || bindSeekValueAs<WString>(query, value)
+    || bindSeekValueAs<WDate>(query, value)
+    || bindSeekValueAs<WDateTime>(query, value)
+    || bindSeekValueAs<WTime>(query, value)
+    || bindSeekValueAs<boost::posix_time::ptime>(query, value);
+}
+
+/*
+ * Returns whether a sort key value is of a type that can be null
+ * (the date/time types map to a nullable column).
+ */
+inline bool isNullableSeekValue(const boost::any& value)
+{
+  return value.type() == typeid(WDate)
+    || value.type() == typeid(WDateTime)
+    || value.type() == typeid(WTime)
+    || value.type() == typeid(boost::posix_time::ptime);
+}
+
+/*
+ * Returns whether a sort key value is null: a null value would be
+ * bound as NULL, for which the seek condition matches no row.
+ */
+inline bool isNullSeekValue(const boost::any& value)
+{
+  if (value.type() == typeid(WDate))
+    return boost::any_cast<WDate>(value).isNull();
+  else if (value.type() == typeid(WDateTime))
+    return boost::any_cast<WDateTime>(value).isNull();
+  else if (value.type() == typeid(WTime))
+    return boost::any_cast<WTime>(value).isNull();
+  else if (value.type() == typeid(boost::posix_time::ptime))
+    return boost::any_cast<boost::posix_time::ptime>(value).is_special();
+  else
+    return false;
+}
+
+    }
 
 template <class Result>
 QueryModel<Result>::QueryModel(WObject *parent)
   : WAbstractTableModel(parent),
     batchSize_(40),
+    keysetPagination_(false),
+    rowCountCaching_(false),
+    idField_(-1),
+    sortField_(-1),
+    sortOrder_(AscendingOrder),
     cachedRowCount_(-1),
     cacheStart_(-1),
-    currentRow_(-1)
+    currentRow_(-1),
+    sortFieldNulls_(-1)
 { }
 
 template <class Result>
@@ -32,13 +107,26 @@ void QueryModel<Result>::setQuery(const Query<Result>& query,
     query_ = query;
     fields_ = query_.fields();
     columns_.clear();
-    reset();
   } else {
     invalidateData();
     query_ = query;
     fields_ = query_.fields();
-    dataReloaded();
   }
+
+  /*
+   * The new query has its own order
+   */
+  sortField_ = idField_ = -1;
+  for (unsigned i = 0; i < fields_.size(); ++i)
+    if (fields_[i].isSurrogateIdField()) {
+      idField_ = i;
+      break;
+    }
+
+  if (!keepColumns)
+    reset();
+  else
+    dataReloaded();
 }
 
 template <class Result>
@@ -47,6 +135,18 @@ void QueryModel<Result>::setBatchSize(int count)
   batchSize_ = count;
 }
 
+template <class Result>
+void QueryModel<Result>::setKeysetPagination(bool enabled)
+{
+  keysetPagination_ = enabled;
+}
+
+template <class Result>
+void QueryModel<Result>::setRowCountCaching(bool enabled)
+{
+  rowCountCaching_ = enabled;
+}
+
 template <class Result>
 int QueryModel<Result>::addColumn(const std::string& field,
 				  const WString& header,
@@ -165,6 +265,9 @@ bool QueryModel<Result>::setData(const WModelIndex& index,
 
     query_result_traits<Result>::setValue(result, column, dbValue);
 
+    if (column == sortField_)
+      clearSeekKeys();
+
     invalidateRow(index.row());
 
     transaction.commit();
@@ -183,6 +286,14 @@ void QueryModel<Result>::invalidateData()
   cache_.clear();
   rowValues_.clear();
   stableIds_.clear();
+  clearSeekKeys();
+}
+
+template <class Result>
+void QueryModel<Result>::clearSeekKeys()
+{
+  seekKeys_.clear();
+  sortFieldNulls_ = -1;
 }
 
 template <class Result>
@@ -201,13 +312,162 @@ void QueryModel<Result>::sort(int column, SortOrder order)
 
   invalidateData();
 
-  query_.orderBy(fields_[columns_[column].fieldIdx_].sql() + " "
-		 + (order == AscendingOrder ? "asc" : "desc"));
+  sortField_ = columns_[column].fieldIdx_;
+  sortOrder_ = order;
+
+  query_.orderBy(sortOrderBy(false));
+
+  if (!keysetPagination_)
+    sortField_ = -1;
 
   cachedRowCount_ = rc;
   dataReloaded();
 }
 
+template <class Result>
+std::string QueryModel<Result>::sortOrderBy(bool reverse) const
+{
+  const char *direction
+    = (sortOrder_ == AscendingOrder) != reverse ? " asc" : " desc";
+
+  std::string result = fields_[sortField_].sql() + direction;
+
+  /*
+   * A seek needs a unique order: use the id to order equal values
+   */
+  if (keysetPagination_ && idField_ != -1 && sortField_ != idField_)
+    result += ", " + fields_[idField_].sql() + direction;
+
+  return result;
+}
+
+template <class Result>
+bool QueryModel<Result>::canSeek() const
+{
+  return keysetPagination_ && sortField_ != -1 && idField_ != -1
+    && queryLimit_ <= 0 && queryOffset_ <= 0;
+}
+
+template <class Result>
+void QueryModel<Result>::saveSeekKey(int row)
+{
+  const Result& result = cache_[row - cacheStart_];
+
+  SeekKey key;
+  key.id = resultId(result);
+
+  if (key.id == -1)
+    return;
+
+  if (sortField_ != idField_) {
+    AnyList values;
+    query_result_traits<Result>::getValues(result, values);
+    key.value = values[sortField_];
+
+    if (!Impl::bindSeekValue<Result>(0, key.value)
+	|| Impl::isNullSeekValue(key.value))
+      return;
+  }
+
+  seekKeys_[row] = key;
+}
+
+/*
+ * The seek condition skips rows with a null sort value, and thus we
+ * cannot seek if the sort column contains a null anywhere. This is
+ * checked once, until the data or the sort changes.
+ */
+template <class Result>
+bool QueryModel<Result>::sortFieldHasNulls()
+{
+  if (sortFieldNulls_ == -1) {
+    Query<Result> query = query_;
+    query.where(fields_[sortField_].sql() + " is null");
+    query.offset(-1);
+    query.limit(1);
+
+    collection<Result> results = query.resultList();
+    sortFieldNulls_ = results.begin() != results.end() ? 1 : 0;
+  }
+
+  return sortFieldNulls_ == 1;
+}
+
+/*
+ * Fetches the batch at cacheStart_ by seeking from the nearest known
+ * sort key: forward from a key before the batch, or backward (in
+ * reverse order) from a key after the batch. Returns false when
+ * an offset from the start would be as cheap.
+ */
+template <class Result>
+bool QueryModel<Result>::seekBatch(int limit)
+{
+  int distance = cacheStart_;
+  typename SeekKeyMap::const_iterator key = seekKeys_.end();
+  bool forward = true;
+
+  typename SeekKeyMap::const_iterator i = seekKeys_.lower_bound(cacheStart_);
+  if (i != seekKeys_.begin()) {
+    typename SeekKeyMap::const_iterator before = i;
+    --before;
+
+    int d = cacheStart_ - before->first - 1;
+    if (d < distance) {
+      distance = d;
+      key = before;
+    }
+  }
+
+  i = seekKeys_.lower_bound(cacheStart_ + limit);
+  if (i != seekKeys_.end()) {
+    int d = i->first - (cacheStart_ + limit);
+    if (d < distance) {
+      distance = d;
+      key = i;
+      forward = false;
+    }
+  }
+
+  if (key == seekKeys_.end())
+    return false;
+
+  if (sortField_ != idField_
+      && Impl::isNullableSeekValue(key->second.value)
+      && sortFieldHasNulls())
+    return false;
+
+  Query<Result> query = query_;
+
+  const char *op
+    = (sortOrder_ == AscendingOrder) == forward ? " > ?" : " < ?";
+  std::string id = fields_[idField_].sql();
+
+  if (sortField_ == idField_)
+    query.where(id + op).bind(key->second.id);
+  else {
+    std::string field = fields_[sortField_].sql();
+
+    query.where(field + op + " or (" + field + " = ? and " + id + op + ")");
+    Impl::bindSeekValue(&query, key->second.value);
+    Impl::bindSeekValue(&query, key->second.value);
+    query.bind(key->second.id);
+  }
+
+  if (!forward)
+    query.orderBy(sortOrderBy(true));
+
+  query.offset(distance);
+  query.limit(limit);
+
+  collection<Result> results = query.resultList();
+  cache_.insert(cache_.end(), results.begin(), results.end());
+
+  if (!forward)
+    std::reverse(cache_.begin(), cache_.end());
+
+  return true;
+}
+
 template <class Result>
 Result QueryModel<Result>::stableResultRow(int row) const
 {
@@ -226,21 +486,24 @@ Result& QueryModel<Result>::resultRow(int row)
       || row >= cacheStart_ + static_cast<int>(cache_.size())) {
     cacheStart_ = std::max(row - batchSize_ / 4, 0);
 
-    int qOffset = cacheStart_;
-    if (queryOffset_ > 0)
-      qOffset += queryOffset_;
-    query_.offset(qOffset);
-
     int qLimit = batchSize_;
     if (queryLimit_ > 0)
       qLimit = std::min(batchSize_, queryLimit_ - cacheStart_);
-    query_.limit(qLimit);
 
     Transaction transaction(query_.session());
 
-    collection<Result> results = query_.resultList();
     cache_.clear();
-    cache_.insert(cache_.end(), results.begin(), results.end());   
+
+    if (!canSeek() || !seekBatch(qLimit)) {
+      int qOffset = cacheStart_;
+      if (queryOffset_ > 0)
+	qOffset += queryOffset_;
+      query_.offset(qOffset);
+      query_.limit(qLimit);
+
+      collection<Result> results = query_.resultList();
+      cache_.insert(cache_.end(), results.begin(), results.end());
+    }
 
     for (unsigned i = 0; i < cache_.size(); ++i) {
       long long id = resultId(cache_[i]);
@@ -248,6 +511,11 @@ Result& QueryModel<Result>::resultRow(int row)
 	stableIds_[cacheStart_ + i] = id;
     }
 
+    if (canSeek() && !cache_.empty()) {
+      saveSeekKey(cacheStart_);
+      saveSeekKey(cacheStart_ + static_cast<int>(cache_.size()) - 1);
+    }
+
     if (row >= cacheStart_ + static_cast<int>(cache_.size()))
       throw Exception("QueryModel: geometry inconsistent with database");
 
@@ -278,7 +546,13 @@ const Result& QueryModel<Result>::resultRow(int row) const
 template <class Result>
 void QueryModel<Result>::reload()
 {
+  int rc = cachedRowCount_;
+
   invalidateData();
+
+  if (rowCountCaching_)
+    cachedRowCount_ = rc;
+
   dataReloaded();
 }
 
@@ -368,6 +642,11 @@ bool QueryModel<Result>::insertRows(int row, int count,
 
   cachedRowCount_ += count;
 
+  /*
+   * A new row may have a null sort value
+   */
+  sortFieldNulls_ = -1;
+
   endInsertRows();
 
   return true;
@@ -384,6 +663,8 @@ bool QueryModel<Result>::removeRows(int row, int count,
     cache_.erase(cache_.begin() + (row - cacheStart_));
   }
 
+  clearSeekKeys();
+
   cachedRowCount_ -= count;
 
   endRemoveRows();
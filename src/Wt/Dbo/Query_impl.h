@@ -7,6 +7,8 @@
 #ifndef WT_DBO_QUERY_IMPL_H_
 #define WT_DBO_QUERY_IMPL_H_
 
+#include <typeinfo>
+
 #include <boost/tuple/tuple.hpp>
 
 #include <Wt/Dbo/Exception>
@@ -121,33 +123,70 @@ QueryBase<Result>::statements(const std::string& where,
 			      const std::string& orderBy,
 			      int limit, int offset) const
 {
-  SqlStatement *statement, *countStatement;
+  /*
+   * The generated SQL depends only on the result type, the query and
+   * its clauses (limit and offset are bound as parameters), and thus
+   * can be reused for another query with the same shape.
+   */
+  std::string key = typeid(Result).name();
+  key += '\0';
+  key += sql_;
+  key += '\0';
+  key += where;
+  key += '\0';
+  key += groupBy;
+  key += '\0';
+  key += orderBy;
+  key += '\0';
+  key += (limit != -1 ? '1' : '0');
+  key += (offset != -1 ? '1' : '0');
+  key += (simpleCount_ ? '1' : '0');
+
+  const Session::QuerySql *sql = this->session_->getQuerySql(key);
+
+  Session::QuerySql generated;
+  if (!sql) {
+    generated = createSql(where, groupBy, orderBy, limit, offset);
+    this->session_->saveQuerySql(key, generated);
+    sql = &generated;
+  }
+
+  SqlStatement *statement = this->session_->getOrPrepareStatement(sql->first);
+  SqlStatement *countStatement
+    = this->session_->getOrPrepareStatement(sql->second);
+
+  return std::make_pair(statement, countStatement);
+}
+
+template <class Result>
+std::pair<std::string, std::string>
+QueryBase<Result>::createSql(const std::string& where,
+			     const std::string& groupBy,
+			     const std::string& orderBy,
+			     int limit, int offset) const
+{
+  std::string sql, countSql;
 
   if (selectFieldLists_.empty()) {
     /*
      * sql_ is "from ..."
      */
-    std::string sql;
-
     std::vector<FieldInfo> fs = this->fields();
     sql = Impl::createQuerySelectSql(sql_, where, groupBy, orderBy,
 				     limit, offset, fs,
 				     this->session_->useRowsFromTo_);
-    statement = this->session_->getOrPrepareStatement(sql);
 
     if (simpleCount_)
-      sql = Impl::createQueryCountSql(sql, sql_, where, groupBy, orderBy,
-				      limit, offset,
-				      this->session_->useRowsFromTo_);
+      countSql = Impl::createQueryCountSql(sql, sql_, where, groupBy, orderBy,
+					   limit, offset,
+					   this->session_->useRowsFromTo_);
     else
-      sql = Impl::createWrappedQueryCountSql(sql);
-
-    countStatement = this->session_->getOrPrepareStatement(sql);
+      countSql = Impl::createWrappedQueryCountSql(sql);
   } else {
     /*
      * sql_ is complete "[with ...] select ..."
      */
-    std::string sql = sql_;
+    sql = sql_;
     int sql_offset = 0;
 
     std::vector<FieldInfo> fs;
@@ -164,20 +203,16 @@ QueryBase<Result>::statements(const std::string& where,
 				       limit, offset, fs,
 				       this->session_->useRowsFromTo_);
 
-    statement = this->session_->getOrPrepareStatement(sql);
-
     if (simpleCount_) {
       std::string from = sql_.substr(selectFieldLists_.front().back().end);
-      sql = Impl::createQueryCountSql(sql, from, where, groupBy, orderBy,
-				      limit, offset,
-				      this->session_->useRowsFromTo_);
+      countSql = Impl::createQueryCountSql(sql, from, where, groupBy, orderBy,
+					   limit, offset,
+					   this->session_->useRowsFromTo_);
     } else
-      sql = Impl::createWrappedQueryCountSql(sql);
-
-    countStatement = this->session_->getOrPrepareStatement(sql);
+      countSql = Impl::createWrappedQueryCountSql(sql);
   }
 
-  return std::make_pair(statement, countStatement);
+  return std::make_pair(sql, countSql);
 }
 
 template <class Result>
@@ -219,13 +254,15 @@ Result QueryBase<Result>::singleResult(const collection<Result>& results) const
 
 template <class Result>
 Query<Result, DirectBinding>::Query()
-  : statement_(0),
+  : fetchSize_(0),
+    statement_(0),
     countStatement_(0)
 { }
 
 template <class Result>
 Query<Result, DirectBinding>::Query(Session& session, const std::string& sql)
   : Impl::QueryBase<Result>(session, sql),
+    fetchSize_(0),
     statement_(0),
     countStatement_(0)
 {
@@ -236,6 +273,7 @@ template <class Result>
 Query<Result, DirectBinding>::Query(Session& session, const std::string& table,
 				    const std::string& where)
   : Impl::QueryBase<Result>(session, table, where),
+    fetchSize_(0),
     statement_(0),
     countStatement_(0)
 {
@@ -272,6 +310,21 @@ void Query<Result, DirectBinding>::reset()
   this->countStatement_->reset();
 }
 
+template <class Result>
+Query<Result, DirectBinding>&
+Query<Result, DirectBinding>::fetchSize(int rows)
+{
+  fetchSize_ = rows;
+
+  return *this;
+}
+
+template <class Result>
+int Query<Result, DirectBinding>::fetchSize() const
+{
+  return fetchSize_;
+}
+
 template <class Result>
 Result Query<Result, DirectBinding>::resultValue() const
 {
@@ -291,7 +344,7 @@ collection<Result> Query<Result, DirectBinding>::resultList() const
   SqlStatement *s = this->statement_, *cs = this->countStatement_;
   this->statement_ = this->countStatement_ = 0;
 
-  return collection<Result>(this->session_, s, cs);
+  return collection<Result>(this->session_, s, cs, fetchSize_);
 }
 
 template <class Result>
@@ -337,14 +390,16 @@ namespace Impl {
 template <class Result>
 Query<Result, DynamicBinding>::Query()
   : limit_(-1),
-    offset_(-1)
+    offset_(-1),
+    fetchSize_(0)
 { }
 
 template <class Result>
 Query<Result, DynamicBinding>::Query(Session& session, const std::string& sql)
   : Impl::QueryBase<Result>(session, sql),
     limit_(-1),
-    offset_(-1)
+    offset_(-1),
+    fetchSize_(0)
 { }
 
 template <class Result>
@@ -353,7 +408,8 @@ Query<Result, DynamicBinding>::Query(Session& session,
 				     const std::string& where)
   : Impl::QueryBase<Result>(session, table, where),
     limit_(-1),
-    offset_(-1)
+    offset_(-1),
+    fetchSize_(0)
 { }
 
 template <class Result>
@@ -364,7 +420,8 @@ Query<Result, DynamicBinding>
     groupBy_(other.groupBy_),
     orderBy_(other.orderBy_),
     limit_(other.limit_),
-    offset_(other.offset_)
+    offset_(other.offset_),
+    fetchSize_(other.fetchSize_)
 { 
   for (unsigned i = 0; i < other.parameters_.size(); ++i)
     parameters_.push_back(other.parameters_[i]->clone());
@@ -381,6 +438,7 @@ Query<Result, DynamicBinding>::operator=
   orderBy_ = other.orderBy_;
   limit_ = other.limit_;
   offset_ = other.offset_;
+  fetchSize_ = other.fetchSize_;
 
   reset();
 
@@ -468,6 +526,21 @@ int Query<Result, DynamicBinding>::limit() const
   return limit_;
 }
 
+template <class Result>
+Query<Result, DynamicBinding>&
+Query<Result, DynamicBinding>::fetchSize(int rows)
+{
+  fetchSize_ = rows;
+
+  return *this;
+}
+
+template <class Result>
+int Query<Result, DynamicBinding>::fetchSize() const
+{
+  return fetchSize_;
+}
+
 template <class Result>
 Result Query<Result, DynamicBinding>::resultValue() const
 {
@@ -490,7 +563,8 @@ collection<Result> Query<Result, DynamicBinding>::resultList() const
   bindParameters(statement);
   bindParameters(countStatement);
 
-  return collection<Result>(this->session_, statement, countStatement);
+  return collection<Result>(this->session_, statement, countStatement,
+			    fetchSize_);
 }
 
 template <class Result>
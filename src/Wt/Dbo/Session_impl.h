@@ -60,7 +60,7 @@ SqlStatement *Session::getStatement(int statementIdx)
   ClassRegistry::iterator i = classRegistry_.find(&typeid(C));
   MappingInfo *mapping = i->second;
 
-  std::string id = statementId(mapping->tableName, statementIdx);
+  const std::string& id = mapping->statementIds[statementIdx];
 
   SqlStatement *result = getStatement(id);
 
@@ -260,6 +260,7 @@ void Session::implSave(MetaDbo<C>& dbo)
     transaction_->objects_.push_back(new ptr<C>(&dbo));
 
   Session::Mapping<C> *mapping = getMapping<C>();
+  tableChanged(*mapping);
 
   SaveDbAction<C> action(dbo, *mapping);
   action.visit(*dbo.obj());
@@ -267,6 +268,128 @@ void Session::implSave(MetaDbo<C>& dbo)
   mapping->registry_[dbo.id()] = &dbo;
 }
 
+template<class C>
+void Session::implSaveBatch(const std::vector<MetaDboBase *>& batch)
+{
+  if (!transaction_)
+    throw Exception("Dbo save(): no active transaction");
+
+  Session::Mapping<C> *mapping = getMapping<C>();
+  tableChanged(*mapping);
+
+  if (mapping->surrogateIdFieldName && !insertReturnsId_) {
+    // we would not know the ids of the inserted objects
+    for (unsigned i = 0; i < batch.size(); ++i)
+      batch[i]->flush();
+
+    return;
+  }
+
+  /*
+   * First flush what the objects depend on: objects of the batch
+   * which are referenced by another object are saved on their own.
+   */
+  for (unsigned i = 0; i < batch.size(); ++i) {
+    MetaDbo<C>& dbo = static_cast<MetaDbo<C>&>(*batch[i]);
+
+    if (dbo.isDirty()) {
+      dbo.state_ &= ~MetaDboBase::NeedsSave;
+      dbo.state_ |= MetaDboBase::Saving;
+
+      try {
+	SaveDbAction<C> action(dbo, *mapping);
+	action.visitDependencies(*dbo.obj());
+      } catch (...) {
+	dbo.state_ &= ~MetaDboBase::Saving;
+	dbo.state_ |= MetaDboBase::NeedsSave;
+	throw;
+      }
+
+      dbo.state_ &= ~MetaDboBase::Saving;
+      dbo.state_ |= MetaDboBase::NeedsSave;
+    }
+  }
+
+  std::vector<MetaDbo<C> *> dbos;
+  for (unsigned i = 0; i < batch.size(); ++i)
+    if (isBatchInsert(batch[i]))
+      dbos.push_back(static_cast<MetaDbo<C> *>(batch[i]));
+
+  for (unsigned i = 0; i < dbos.size();) {
+    unsigned rows = insertBatchRows(mapping, dbos.size() - i);
+
+    if (rows == 1)
+      dbos[i]->flush();
+    else
+      implInsertBatch(dbos, i, rows);
+
+    i += rows;
+  }
+}
+
+template<class C>
+void Session::implInsertBatch(std::vector<MetaDbo<C> *>& dbos,
+			      unsigned start, unsigned count)
+{
+  Session::Mapping<C> *mapping = getMapping<C>();
+
+  for (unsigned i = start; i < start + count; ++i) {
+    MetaDbo<C>& dbo = *dbos[i];
+
+    dbo.state_ &= ~MetaDboBase::NeedsSave;
+    dbo.state_ |= MetaDboBase::Saving;
+
+    transaction_->objects_.push_back(new ptr<C>(&dbo));
+  }
+
+  std::vector<bool> needSetsPass(count);
+
+  try {
+    SqlStatement *statement
+      = getInsertBatchStatement(mapping->tableName, count);
+    ScopedStatementUse use(statement);
+
+    statement->reset();
+    int column = 0;
+
+    for (unsigned i = 0; i < count; ++i) {
+      MetaDbo<C>& dbo = *dbos[start + i];
+
+      SaveDbAction<C> action(dbo, *mapping);
+      needSetsPass[i] = action.bindInsert(*dbo.obj(), statement, column);
+    }
+
+    statement->execute();
+
+    if (mapping->surrogateIdFieldName) {
+      for (unsigned i = 0; i < count; ++i) {
+	long long id;
+	if (!statement->nextRow() || !statement->getResult(0, &id))
+	  throw Exception("Dbo flush(): batched insert did not return "
+			  "all ids");
+
+	dbos[start + i]->setAutogeneratedId(id);
+      }
+    }
+  } catch (...) {
+    for (unsigned i = start; i < start + count; ++i)
+      dbos[i]->setTransactionState(MetaDboBase::SavedInTransaction);
+    throw;
+  }
+
+  for (unsigned i = 0; i < count; ++i) {
+    MetaDbo<C>& dbo = *dbos[start + i];
+
+    dbo.setTransactionState(MetaDboBase::SavedInTransaction);
+    mapping->registry_[dbo.id()] = &dbo;
+
+    if (needSetsPass[i]) {
+      SaveDbAction<C> action(dbo, *mapping);
+      action.visitSets(*dbo.obj());
+    }
+  }
+}
+
 template<class C>
 void Session::implDelete(MetaDbo<C>& dbo)
 {
@@ -277,6 +400,8 @@ void Session::implDelete(MetaDbo<C>& dbo)
   if (!dbo.savedInTransaction())
     transaction_->objects_.push_back(new ptr<C>(&dbo));
 
+  tableChanged(*getMapping<C>());
+
   bool versioned = getMapping<C>()->versionFieldName && dbo.obj() != 0;
   SqlStatement *statement
     = getStatement<C>(versioned ? SqlDeleteVersioned : SqlDelete);
@@ -254,7 +254,7 @@ collection<C>::collection()
 
 template <class C>
 collection<C>::collection(Session *session, SqlStatement *statement,
-			  SqlStatement *countStatement)
+			  SqlStatement *countStatement, int fetchSize)
   : session_(session),
     type_(QueryCollection)
 {
@@ -263,6 +263,7 @@ collection<C>::collection(Session *session, SqlStatement *statement,
   data_.query->statement = statement;
   data_.query->countStatement = countStatement;
   data_.query->size = -1;
+  data_.query->fetchSize = fetchSize;
 }
 
 template <class C>
@@ -335,9 +336,11 @@ SqlStatement *collection<C>::executeStatement() const
   if (session_)
     session_->flush();
 
-  if (type_ == QueryCollection)
+  if (type_ == QueryCollection) {
     statement = data_.query->statement;
-  else {
+    if (statement)
+      statement->setFetchSize(data_.query->fetchSize);
+  } else {
     if (data_.relation.sql) {
       statement = session_->getOrPrepareStatement(*data_.relation.sql);
       int column = 0;
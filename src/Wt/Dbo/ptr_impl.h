@@ -96,6 +96,14 @@ void MetaDbo<C>::flush()
   }
 }
 
+template <class C>
+void MetaDbo<C>::flushBatch(const std::vector<MetaDboBase *>& batch)
+{
+  checkNotOrphaned();
+
+  session()->template implSaveBatch<C>(batch);
+}
+
 template <class C>
 void MetaDbo<C>::bindId(SqlStatement *statement, int& column)
 {
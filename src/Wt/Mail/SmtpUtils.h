@@ -0,0 +1,42 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+
+#ifndef WT_MAIL_SMTP_UTILS_H_
+#define WT_MAIL_SMTP_UTILS_H_
+
+#include <string>
+#include "Wt/Mail/Message"
+#include <Wt/WDllDefs.h>
+
+#include <boost/system/error_code.hpp>
+
+namespace Wt {
+  namespace Mail {
+    namespace SmtpUtils {
+
+      /*
+       * The message as sent after the DATA command: as written by
+       * Message::write(), which dot-stuffs the lines, and terminated
+       * by a line with a single '.'
+       */
+      WT_API extern std::string messageData(const Message& message);
+
+      /*
+       * Whether a reply code is a temporary failure, for which
+       * delivery may be retried later.
+       */
+      WT_API extern bool isTransient(int replyCode);
+
+      /*
+       * The error reported for a failure reply code.
+       */
+      WT_API extern boost::system::error_code replyError(int replyCode);
+    }
+  }
+}
+
+#endif // WT_MAIL_SMTP_UTILS_H_
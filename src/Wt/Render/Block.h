@@ -15,6 +15,7 @@
 #include "web/DomElement.h"
 #include "LayoutBox.h"
 #include "rapidxml/rapidxml.hpp"
+#include "Wt/Render/CssData.h"
 #include "Wt/Render/Specificity.h"
 
 namespace Wt {
@@ -113,16 +114,6 @@ private:
     IgnorePercentage
   };
 
-  struct PropertyValue
-  {
-    PropertyValue() { }
-    PropertyValue(const std::string& value, const Specificity& s)
-      : value_(value), s_(s) { }
-
-    std::string value_;
-    Specificity s_;
-  };
-
   rapidxml::xml_node<> *node_;
   Block *parent_;
   BlockList offsetChildren_;
@@ -134,17 +125,15 @@ private:
   const LayoutBox *currentTheadBlock_;
   double currentWidth_;
   double contentsHeight_;
-  mutable std::map<std::string, PropertyValue> css_;
+  mutable std::vector<std::string> css_; // by property - PropertyStylePosition
   StyleSheet* styleSheet_;
 
   int attributeValue(const char *attribute, int defaultValue) const;
 
-  void updateAggregateProperty(const std::string& property,
-                               const std::string& aggregate,
-                               const Specificity& spec,
-                               const std::string& value) const;
-  void fillinStyle(const std::string& style,
-                   const Specificity &specificity) const;
+  void computeStyle() const;
+  void fillinStyle(const DeclarationList& declarations,
+                   const Specificity& specificity,
+                   std::vector<Specificity>& propertySpecificity) const;
   bool isPositionedAbsolutely() const;
   std::string inheritedCssProperty(Property property) const;
   double cssWidth(double fontScale) const;
@@ -253,7 +242,6 @@ private:
   static void unsupportedCssValue(Property property,
 				  const std::string& value);
 
-  static bool isAggregate(const std::string& cssProperty);
 
   bool isTableCell() const
     { return type_ == DomElement_TD || type_ == DomElement_TH; }
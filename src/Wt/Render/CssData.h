@@ -4,6 +4,7 @@
 #include <Wt/WDllDefs.h>
 #include <Wt/WString>
 #include "Wt/Render/Specificity.h"
+#include "web/DomElement.h"
 
 namespace Wt{
 namespace Render{
@@ -62,12 +63,34 @@ public:
   Type type_;
 };
 
+/*
+ * A declaration, in terms of the style properties used by the layout:
+ * the aggregate properties margin, padding and border are expanded to
+ * a property for each side.
+ */
+struct Declaration
+{
+  Property property;
+  std::string value;
+};
+
+typedef std::vector<Declaration> DeclarationList;
+
+/*
+ * Parses the declarations from a declaration string (such as a style
+ * attribute), appending them to result. Properties that are not used
+ * by the layout are ignored.
+ */
+extern void parseDeclarations(const std::string& declarationString,
+			      DeclarationList& result);
+
 class DeclarationBlock
 {
 public:
   virtual ~DeclarationBlock(){}
   virtual Term value(const std::string& property) const = 0;
   virtual std::string declarationString() const = 0;
+  virtual const DeclarationList& declarations() const = 0;
 };
 
 class Ruleset
@@ -84,6 +107,14 @@ public:
   virtual ~StyleSheet(){}
   virtual unsigned int   rulesetSize()    const = 0;
   virtual const Ruleset& rulesetAt(int i) const = 0;
+
+  /*
+   * Returns the indexes of the rulesets that could match the block, in
+   * style sheet order: rulesets whose last simple selector does not
+   * match the id, a class or the tag of the block are left out.
+   */
+  virtual void candidateRulesets(const Block *block,
+				 std::vector<int>& result) const = 0;
 };
 
 class Match
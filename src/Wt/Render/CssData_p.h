@@ -70,9 +70,13 @@ public:
   DeclarationBlockImpl() { }
   virtual Term value(const std::string& property) const;
   virtual std::string declarationString() const { return declarationString_; }
+  virtual const DeclarationList& declarations() const { return declarations_; }
+
+  void setDeclarationString(const std::string& s);
 
   std::map<std::string, Term > properties_;
   std::string declarationString_;
+  DeclarationList declarations_;
 };
 
 class RulesetImpl : public Ruleset
@@ -94,8 +98,27 @@ public:
   StyleSheetImpl() { }
   virtual unsigned int   rulesetSize()    const { return rulesetArray_.size(); }
   virtual const Ruleset& rulesetAt(int i) const { return rulesetArray_[i]; }
+  virtual void candidateRulesets(const Block *block,
+				 std::vector<int>& result) const;
+
+  void addRuleset(const RulesetImpl& ruleset);
 
   std::vector<RulesetImpl> rulesetArray_;
+
+private:
+  typedef std::map<std::string, std::vector<int> > RulesetIndex;
+  typedef std::map<DomElementType, std::vector<int> > RulesetTagIndex;
+
+  /*
+   * Rulesets, by the id, first class or tag of their last simple
+   * selector
+   */
+  RulesetIndex byId_, byClass_;
+  RulesetTagIndex byTag_;
+  std::vector<int> other_;
+
+  static void addCandidates(const RulesetIndex& index, const std::string& key,
+			    std::vector<int>& result);
 };
 
 }
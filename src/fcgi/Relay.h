@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+// This may look like C code, but it's really -*- C++ -*-
+#ifndef WT_FCGI_RELAY_H_
+#define WT_FCGI_RELAY_H_
+
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace Wt {
+
+class WServer;
+
+/*
+ * Copies FastCGI records from the web server to a session, and from
+ * the session to the web server, until the session ends the request.
+ *
+ * The sockets are serviced asynchronously by the I/O service: a
+ * relay does not occupy a thread while it waits for data, and there
+ * is no limit (such as FD_SETSIZE) on the number of relays.
+ */
+class Relay : public boost::enable_shared_from_this<Relay>
+{
+public:
+  Relay(WServer& wt, int serverSocket, int clientSocket);
+  ~Relay();
+
+  void start();
+
+private:
+  typedef boost::asio::local::stream_protocol::socket Socket;
+
+  /*
+   * Records flow in two directions, each reading from one socket
+   * and writing to the other.
+   */
+  struct Direction {
+    Direction(Socket& from, Socket& to, bool fromApplication);
+
+    Socket& from;
+    Socket& to;
+    bool fromApplication;
+    std::vector<unsigned char> record;
+  };
+
+  WServer& wt_;
+  boost::asio::io_service::strand strand_;
+  Socket serverSocket_, clientSocket_;
+  Direction toApplication_, toServer_;
+  bool closed_;
+
+  void readHeader(Direction& d);
+  void handleReadHeader(Direction& d, const boost::system::error_code& error);
+  void handleReadContent(Direction& d, const boost::system::error_code& error);
+  void handleWrite(Direction& d, const boost::system::error_code& error);
+  void close();
+};
+
+typedef boost::shared_ptr<Relay> RelayPtr;
+
+}
+
+#endif // WT_FCGI_RELAY_H_
@@ -9,6 +9,11 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <sys/types.h>
+
+#include <boost/asio.hpp>
+#include <boost/shared_ptr.hpp>
 
 #ifdef WT_THREADED
 #include <boost/thread.hpp>
@@ -27,13 +32,13 @@ class Server
 public:
   static bool bindUDStoStdin(const std::string& socketPath,
 			     Wt::WServer& server);
+  static std::string idleSocketPath(Wt::WServer& server, pid_t pid);
 
   Server(WServer& wt, int argc, char *argv[]);
   int run();
 
   static Server *instance;
 
-  void handleSigChld();
   void handleSignal(const char *signal);
 
 private:
@@ -41,6 +46,14 @@ private:
   int argc_;
   char **argv_;
 
+  /*
+   * SIGCHLD is handled on the I/O service, not in signal context
+   */
+  boost::asio::signal_set childSignals_;
+
+  void waitForChildSignal();
+  void handleSigChld(const boost::system::error_code& error);
+
 #ifdef WT_THREADED
   // mutex to protect access to the sessions map
   boost::recursive_mutex mutex_;
@@ -66,6 +79,28 @@ private:
   void handleRequestThreaded(int serverSocket);
   void handleRequest(int serverSocket);
 
+  /*
+   * Pre-spawned (idle) processes for DedicatedProcess session policy
+   */
+  struct AssignedProcess;
+  typedef boost::shared_ptr<AssignedProcess> AssignedProcessPtr;
+
+  std::vector<pid_t> idleProcessPids_;
+  int idleProcessFailures_;
+  time_t idleProcessFailureTime_;
+
+  // modification time of the executable from which a process was spawned
+  std::map<pid_t, time_t> processExecutableTimes_;
+
+  time_t executableTime() const;
+  bool isStale(pid_t pid, time_t executableTime) const;
+  void spawnIdleProcesses();
+  void retireStaleIdleProcesses();
+  pid_t assignIdleProcess(const std::string& sessionId);
+  void watchAssignedProcess(pid_t pid, int socket);
+  void handleProcessIdle(AssignedProcessPtr process,
+			 const boost::system::error_code& error);
+
   /*
    * For SharedProcess session policy
    */
@@ -0,0 +1,102 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_COMPRESSED_FILE_CACHE_HPP
+#define HTTP_COMPRESSED_FILE_CACHE_HPP
+
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/cstdint.hpp>
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+// For ::int64_t and ::uint64_t on Windows only
+#include "Wt/WDllDefs.h"
+
+namespace Wt {
+  class WIOService;
+}
+
+namespace http {
+namespace server {
+
+/// A cache of gzip-compressed static files.
+/*
+ * Static files for which there is no precompressed .gz sibling are
+ * compressed only once, and kept in memory for as long as they are not
+ * modified and have not been evicted (least recently used first) to keep
+ * the cache within its size limit.
+ *
+ * Files are compressed in the thread pool, not in the I/O thread that
+ * serves the request: until the compressed version is ready, the file
+ * is served uncompressed.
+ */
+class CompressedFileCache
+  : private boost::noncopyable
+{
+public:
+  typedef boost::shared_ptr<const std::string> Data;
+
+  /// Construct a cache that holds up to maxSize bytes of compressed data.
+  /*
+   * Files are compressed by posting to the given I/O service.
+   */
+  CompressedFileCache(::int64_t maxSize, Wt::WIOService& ioService);
+
+  /// Returns the gzip-compressed contents of a file.
+  /*
+   * The etag identifies the version of the file (it encodes its size
+   * and modification time). Returns an empty pointer if the file should
+   * not or could not be compressed, or if it is not yet compressed: in
+   * that case, compression is started in the background.
+   */
+  Data get(const std::string& path, const std::string& etag,
+	   ::int64_t fileSize);
+
+  /// Returns whether the cache is enabled (maxSize > 0).
+  bool enabled() const { return maxSize_ > 0; }
+
+private:
+  struct Entry {
+    std::string path, etag;
+    Data data;
+  };
+
+  typedef std::list<Entry> EntryList;
+  typedef std::map<std::string, EntryList::iterator> EntryMap;
+
+  Wt::WIOService& ioService_;
+  ::int64_t maxSize_, size_;
+
+  /// Most recently used entries are at the front.
+  EntryList lru_;
+  EntryMap entries_;
+
+  /// Paths of files that are being compressed.
+  std::set<std::string> pending_;
+
+#ifdef WT_THREADED
+  /// Mutex to protect access to lru_, entries_ and pending_
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  static Data compress(const std::string& path);
+  void add(const std::string& path, const std::string& etag);
+  void erase(EntryMap::iterator i);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_COMPRESSED_FILE_CACHE_HPP
@@ -41,6 +41,7 @@ public:
   void setOptions(int argc, char **argv, const std::string& configurationFile);
 
   int threads() const { return threads_; }
+  int acceptThreads() const { return acceptThreads_; }
   const std::string& docRoot() const { return docRoot_; }
   const std::string& appRoot() const { return appRoot_; }
   bool defaultStatic() const { return defaultStatic_; }
@@ -51,6 +52,7 @@ public:
   const std::string& pidPath() const { return pidPath_; }
   const std::string& serverName() const { return serverName_; }
   bool compression() const { return compression_; }
+  ::int64_t compressionCacheSize() const { return compressionCacheSize_; }
   bool gdb() const { return gdb_; }
   const std::string& configPath() const { return configPath_; }
 
@@ -90,6 +92,7 @@ private:
   bool silent_;
 
   int threads_;
+  int acceptThreads_;
   std::string docRoot_, appRoot_;
   bool defaultStatic_;
   std::vector<std::string> staticPaths_;
@@ -98,6 +101,7 @@ private:
   std::string pidPath_;
   std::string serverName_;
   bool compression_;
+  ::int64_t compressionCacheSize_;
   bool gdb_;
   std::string configPath_;
 
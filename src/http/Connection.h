@@ -65,6 +65,9 @@ public:
   Server *server() const { return server_; }
   asio::strand& strand() { return strand_; }
 
+  /// The io_service which serves this connection.
+  asio::io_service& service() { return io_service_; }
+
   /// Stop all asynchronous operations associated with the connection.
   void scheduleStop();
 
@@ -92,6 +95,8 @@ protected:
   /// The manager for this connection.
   ConnectionManager& ConnectionManager_;
 
+  asio::io_service& io_service_;
+
   asio::strand strand_;
 
   void finishReply();
@@ -126,6 +131,14 @@ private:
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout) = 0;
 
+  /*
+   * Asynchronoulsy writing a file region, without copying it through
+   * userspace (sendfile)
+   */
+  virtual bool sendFileSupported() const { return false; }
+  virtual void startAsyncSendFile(int fd, ::int64_t offset, ::int64_t count,
+				  int timeout);
+
   /// The handler used to process the incoming request.
   RequestHandler& request_handler_;
 
@@ -28,6 +28,7 @@ namespace asio = boost::asio;
 
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/version.hpp>
 
 #include <boost/tuple/tuple.hpp>
 #ifdef WTHTTP_WITH_ZLIB
@@ -40,6 +41,11 @@ namespace asio = boost::asio;
 #include "WHttpDllDefs.h"
 #include "Request.h"
 
+#if defined(WTHTTP_WITH_SENDFILE) && BOOST_VERSION < 104700
+// we need asio's native_non_blocking() to drive sendfile()
+#undef WTHTTP_WITH_SENDFILE
+#endif
+
 namespace http {
 namespace server {
 
@@ -105,6 +111,7 @@ public:
 
   void setConnection(ConnectionPtr connection);
   bool nextBuffers(std::vector<asio::const_buffer>& result);
+  bool nextFileRegion(int& fd, ::int64_t& offset, ::int64_t& count);
   bool closeConnection() const;
   void setCloseConnection() { closeConnection_ = true; }
 
@@ -133,9 +140,17 @@ protected:
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result) = 0;
 
+  /*
+   * Offers the (remaining) content as a region of an open file, which
+   * a connection may transmit without copying it through userspace.
+   * Returns false if the content is not backed by a file.
+   */
+  virtual bool nextContentFile(int& fd, ::int64_t& offset, ::int64_t& count);
+
   void setRelay(ReplyPtr reply);
 
   static std::string httpDate(time_t t);
+  static bool isCompressible(const std::string& contentType);
 
   ConnectionPtr getConnection() { return connection_.lock(); }
   bool transmitting() const { return transmitting_; }
@@ -25,6 +25,7 @@
 
 // For ::int64_ and ::uint64_t on Windows only
 #include "Wt/WDllDefs.h"
+#include "WHttpDllDefs.h"
 
 #ifdef HTTP_WITH_SSL
 #include <openssl/ssl.h>
@@ -38,22 +39,64 @@ namespace http {
 namespace server {
 
 /*
- * boost::is_iless throws bad_cast -- here is my ad hoc version.
+ * boost::iequals throws bad_cast -- here is my ad hoc version.
  */
-struct my_iless
+inline bool my_iequals(const std::string& a, const std::string& b)
 {
-  bool operator()(const std::string& a, const std::string& b) const {
+  if (a.length() != b.length())
+    return false;
+
 #if defined(WIN32) && !defined(__CYGWIN__)
-    return _stricmp(a.c_str(), b.c_str()) < 0;
+  return _stricmp(a.c_str(), b.c_str()) == 0;
 #else
-    return strcasecmp(a.c_str(), b.c_str()) < 0;
+  return strcasecmp(a.c_str(), b.c_str()) == 0;
 #endif
-  }
+}
+
+/// The headers of a request, in the order in which they were received.
+/*
+ * A request carries only a handful of headers, for which a linear scan
+ * of a flat table beats a tree. Clearing the table keeps the strings, so
+ * that a keep-alive connection can parse the next request's headers
+ * without allocating.
+ */
+class WTHTTP_API HeaderMap
+{
+public:
+  typedef std::pair<std::string, std::string> value_type;
+  typedef std::vector<value_type>::iterator iterator;
+  typedef std::vector<value_type>::const_iterator const_iterator;
+
+  HeaderMap() : size_(0) { }
+
+  iterator begin() { return headers_.begin(); }
+  iterator end() { return headers_.begin() + size_; }
+  const_iterator begin() const { return headers_.begin(); }
+  const_iterator end() const { return headers_.begin() + size_; }
+
+  bool empty() const { return size_ == 0; }
+  std::size_t size() const { return size_; }
+
+  /// Finds a header by (case insensitive) name.
+  iterator find(const std::string& name);
+  const_iterator find(const std::string& name) const;
+
+  /// Appends a header (which may reuse storage of a cleared table).
+  value_type& add();
+
+  /// Removes a header, returns the next one.
+  iterator erase(iterator i);
+
+  void clear() { size_ = 0; }
+
+private:
+  std::vector<value_type> headers_;
+  std::size_t size_;
 };
 
 /// A request received from a client.
 /// A request with a body will have a content-length.
-class Request
+class WTHTTP_API Request
 {
 public:
   enum State { Partial, Complete, Error };
@@ -66,9 +109,8 @@ public:
   int http_version_major;
   int http_version_minor;
 
-  typedef std::map<std::string, std::string, my_iless> HeaderMap;
+  typedef http::server::HeaderMap HeaderMap;
   HeaderMap headerMap;
-  std::vector<HeaderMap::iterator> headerOrder;
   ::int64_t contentLength;
   int webSocketVersion;
 
@@ -22,6 +22,7 @@
 
 #include "Wt/WLogger"
 
+#include "CompressedFileCache.h"
 #include "Configuration.h"
 #include "Reply.h"
 #include "../web/Configuration.h"
@@ -38,9 +39,10 @@ class RequestHandler
 {
 public:
   /// Construct with a directory containing files to be served.
-  explicit RequestHandler(const Configuration &config,
-			  const Wt::EntryPointList& entryPoints,
-			  Wt::WLogger& logger);
+  RequestHandler(const Configuration &config,
+		 const Wt::EntryPointList& entryPoints,
+		 Wt::WLogger& logger,
+		 Wt::WIOService& ioService);
 
   /// Handle a request and produce a reply.
   ReplyPtr handleRequest(Request& req);
@@ -59,6 +61,8 @@ private:
   const Wt::EntryPointList& entryPoints_;
   /// The logger
   Wt::WLogger& logger_;
+  /// Compressed static files
+  CompressedFileCache compressedFiles_;
 
   /// Perform URL-decoding on a string and separates in path and
   /// query. Returns false if the encoding was invalid.
@@ -30,7 +30,7 @@ class Request;
 class Server;
 
 /// Parser for incoming requests.
-class RequestParser
+class WTHTTP_API RequestParser
 {
 public:
   /// Construct ready to parse the request method.
@@ -72,9 +72,30 @@ private:
   static bool is_digit(int c);
 
   bool consumeChar(char input);
+  bool consumeSpan(Buffer::iterator begin, Buffer::iterator end);
   void consumeToString(std::string& result, int maxSize);
   void consumeComplete();
 
+  /// Returns the end of the span of input that cannot change the state.
+  Buffer::iterator scanSpan(Buffer::iterator begin, Buffer::iterator end)
+    const;
+
+  void mergeHeaders(Request& req);
+
+  /// Character classes, for scanning the input in bulk
+  enum CharClass {
+    TokenChar = 0x1, // method, header name
+    UriChar = 0x2,
+    ValueChar = 0x4  // header value
+  };
+
+  struct CharClassTable {
+    CharClassTable();
+    unsigned char classes[256];
+  };
+
+  static const CharClassTable charClasses_;
+
   Request::State parseWebSocketMessage(Request& req, ReplyPtr reply,
 				       Buffer::iterator& begin,
 				       Buffer::iterator end);
@@ -131,9 +152,6 @@ private:
   unsigned char wsCount_;
   unsigned wsMask_;
 
-  std::string  headerName_;
-  std::string  headerValue_;
-
   ::uint64_t   requestSize_;
 
   // used for HTTP POST body and ws frame/payload length
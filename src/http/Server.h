@@ -24,6 +24,7 @@ namespace asio = boost::asio;
 #endif // HTTP_WITH_SSL
 
 #include <string>
+#include <vector>
 #include <boost/noncopyable.hpp>
 #include <boost/version.hpp>
 
@@ -39,6 +40,10 @@ namespace asio = boost::asio;
 
 #include "Wt/WLogger"
 
+namespace boost {
+  class thread;
+}
+
 namespace http {
 namespace server {
 
@@ -86,6 +91,54 @@ private:
   /// Handle a request to resume the server.
   void handleResume();
 
+  /// Opens, binds and listens an acceptor
+  void listen(asio::ip::tcp::acceptor& acceptor,
+	      const asio::ip::tcp::endpoint& endpoint, bool reusePort);
+
+  /*
+   * An event loop that runs in its own thread with its own
+   * io_service, and which accepts connections on its own
+   * (SO_REUSEPORT) acceptors. Connections accepted by a loop are
+   * served by that loop until they are closed.
+   */
+  struct IOLoop {
+    IOLoop();
+
+    asio::io_service service;
+    asio::io_service::work *work;
+
+    asio::ip::tcp::acceptor tcp_acceptor;
+    TcpConnectionPtr new_tcpconnection;
+
+#ifdef HTTP_WITH_SSL
+    asio::ip::tcp::acceptor ssl_acceptor;
+    SslConnectionPtr new_sslconnection;
+#endif // HTTP_WITH_SSL
+
+    boost::thread *thread;
+  };
+
+  /// The event loops, if connections are not served by the thread pool
+  std::vector<IOLoop *> loops_;
+
+  /// Starts the threads of the event loops
+  void startLoops();
+
+  /// Stops the threads of the event loops
+  void stopLoops();
+
+  /// Starts accepting http/https connections in an event loop
+  void startLoopAccept(IOLoop *loop);
+
+  /// Handle completion of an asynchronous accept operation in an event loop.
+  void handleLoopTcpAccept(IOLoop *loop, const asio_error_code& e);
+
+  /// Handle a request to stop accepting connections in an event loop.
+  void handleLoopStop(IOLoop *loop);
+
+  /// Handle a request to resume, in the event loop with the given index.
+  void handleLoopResume(unsigned index);
+
   /// The server's configuration
   Configuration config_;
 
@@ -114,6 +167,9 @@ private:
   /// Handle completion of an asynchronous SSL accept operation.
   void handleSslAccept(const asio_error_code& e);
 
+  /// Handle completion of an asynchronous SSL accept operation in a loop.
+  void handleLoopSslAccept(IOLoop *loop, const asio_error_code& e);
+
   /// The next SSL connection to be accepted.
   SslConnectionPtr new_sslconnection_;
 #endif // HTTP_WITH_SSL
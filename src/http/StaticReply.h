@@ -24,6 +24,7 @@
 namespace asio = boost::asio;
 
 #include "Reply.h"
+#include "CompressedFileCache.h"
 
 namespace http {
 namespace server {
@@ -35,7 +36,9 @@ class StaticReply : public Reply
 {
 public:
   StaticReply(const std::string &full_path, const std::string &extension,
-	      const Request& request, const Configuration& configuration);
+	      const Request& request, const Configuration& configuration,
+	      CompressedFileCache& compressedFiles);
+  virtual ~StaticReply();
 
   virtual void consumeData(Buffer::const_iterator begin,
 			   Buffer::const_iterator end,
@@ -46,12 +49,16 @@ protected:
   virtual ::int64_t contentLength();
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result);
+  virtual bool nextContentFile(int& fd, ::int64_t& offset, ::int64_t& count);
 
 private:
   std::string     path_;
   std::string     extension_;
   std::ifstream   stream_;
   ::int64_t fileSize_;
+  int fd_;
+  bool fileSent_;
+  CompressedFileCache::Data compressed_;
 
   char buf_[64 * 1024];
 
@@ -52,10 +52,25 @@ protected:
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout);
 
+#ifdef WTHTTP_WITH_SENDFILE
+  virtual bool sendFileSupported() const { return true; }
+  virtual void startAsyncSendFile(int fd, ::int64_t offset, ::int64_t count,
+				  int timeout);
+#endif // WTHTTP_WITH_SENDFILE
+
   virtual void stop();
 
   /// Socket for the connection.
   asio::ip::tcp::socket socket_;
+
+private:
+#ifdef WTHTTP_WITH_SENDFILE
+  void handleSendFile(const asio_error_code& e);
+
+  /// The file region that is being transmitted.
+  int sendFileFd_, sendFileTimeout_;
+  ::int64_t sendFileOffset_, sendFileRemaining_;
+#endif // WTHTTP_WITH_SENDFILE
 };
 
 typedef boost::shared_ptr<TcpConnection> TcpConnectionPtr;
@@ -40,28 +40,40 @@ public:
   void parse(WebRequest& request, ReadOption option);
 
 private:
+  /*
+   * A string to search for, with the shift table for a
+   * Boyer-Moore-Horspool search.
+   */
+  struct Pattern {
+    std::string text;
+    int shift[256];
+
+    Pattern(const std::string& text);
+  };
+
   void readMultipartData(WebRequest& request, const std::string type,
 			 ::int64_t len);
-  bool parseBody(WebRequest& request, const std::string boundary);
-  bool parseHead(WebRequest& request);
+  bool parseBody(WebRequest& request, const Pattern& boundary);
+  bool parseHead(WebRequest& request, const Pattern& headerEnd);
   ::int64_t maxPostData_, left_;
   std::ostream *spoolStream_;
   WebRequest *request_;
 
   std::string currentKey_;
 
-  void readUntilBoundary(WebRequest& request, const std::string boundary,
+  void readUntilBoundary(WebRequest& request, const Pattern& boundary,
 			 int tossAtBoundary,
 			 std::string *resultString,
 			 std::ostream *resultFile);
+  void readMore(WebRequest& request);
   void windBuffer(int offset);
-  int index(const std::string search);
+  int index(const Pattern& search);
 
-  enum {BUFSIZE = 8192};
+  enum {BUFSIZE = 64*1024};
   enum {MAXBOUND = 100};
 
   int buflen_;
-  static char buf_[BUFSIZE + MAXBOUND];
+  std::vector<char> buf_;
 };
 
 }
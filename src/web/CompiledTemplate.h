@@ -0,0 +1,83 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef COMPILED_TEMPLATE_H_
+#define COMPILED_TEMPLATE_H_
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+
+#include "Wt/WString"
+
+namespace Wt {
+
+/*
+ * A template text, as understood by WTemplate, parsed into a list of
+ * instructions: literal spans of the text, and placeholders.
+ *
+ * Compiled templates are immutable, and are shared through a
+ * process-wide cache (see get()), keyed on the template text. Rendering
+ * a template thus becomes a linear walk over its instructions, see
+ * WTemplate::renderTemplateText().
+ */
+class CompiledTemplate
+{
+public:
+  struct Instruction {
+    enum Type {
+      Literal,        // text span [begin, begin + length)
+      Variable,       // ${name args}, or ${fun:arg0 args}
+      BeginCondition, // ${<name>}, end is the index of its EndCondition
+      EndCondition,   // ${</name>}
+      Error           // stop rendering, name is the error message
+    };
+
+    Type type;
+    std::size_t begin, length, end;
+
+    std::string name;
+    std::vector<WString> args;
+
+    // for ${fun:arg0 args}: fun, and arg0 followed by args
+    bool isFunction;
+    std::string function;
+    std::vector<WString> functionArgs;
+
+    Instruction(Type aType)
+      : type(aType), begin(0), length(0), end(0), isFunction(false)
+    { }
+  };
+
+  typedef std::vector<Instruction> Instructions;
+
+  const std::string& text() const { return text_; }
+  const Instructions& instructions() const { return instructions_; }
+
+  /*
+   * Returns the compiled template for the given text, from the cache
+   * if possible.
+   */
+  static boost::shared_ptr<const CompiledTemplate>
+  get(const std::string& text);
+
+private:
+  std::string text_;
+  Instructions instructions_;
+
+  CompiledTemplate(const std::string& text);
+
+  void compile();
+  void addLiteral(std::size_t begin, std::size_t end);
+  void addError(const std::string& message);
+};
+
+}
+
+#endif // COMPILED_TEMPLATE_H_
@@ -122,6 +122,9 @@ public:
   int numProcesses() const;
   int numThreads() const;
   int maxNumSessions() const;
+  int minIdleProcesses() const;
+  int maxIdleProcesses() const;
+  int maxSessionsPerProcess() const;
   ::int64_t maxRequestSize() const;
   ::int64_t isapiMaxMemoryRequestSize() const;
   SessionTracking sessionTracking() const;
@@ -196,6 +199,9 @@ private:
   int             numProcesses_;
   int             numThreads_;
   int             maxNumSessions_;
+  int             minIdleProcesses_;
+  int             maxIdleProcesses_;
+  int             maxSessionsPerProcess_;
   ::int64_t       maxRequestSize_;
   ::int64_t       isapiMaxMemoryRequestSize_;
   SessionTracking sessionTracking_;
@@ -0,0 +1,99 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef MAIN_SCRIPT_CACHE_H_
+#define MAIN_SCRIPT_CACHE_H_
+
+#include <map>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace Wt {
+
+class Configuration;
+class WebRequest;
+
+/*
+ * A cache of the static part of the main script: jQuery and the Wt.js
+ * runtime, with all of its template substitutions done.
+ *
+ * Only a few inputs vary between sessions (the application class, a
+ * custom jQuery, ugly internal paths, and the configuration). A script
+ * is rendered (and compressed) once for each combination of these, and
+ * shared by all sessions. Session specific values are passed to the
+ * script by a small preamble (see WebRenderer::serveMainscript()).
+ *
+ * A script is versioned on a hash of its contents. That allows it to be
+ * served from a session independent URL (see url()), which the browser
+ * may cache indefinitely.
+ */
+class MainScriptCache
+{
+public:
+  struct Script {
+    std::string version;
+    std::string text;
+    std::string gzipped; // empty when not compressed
+  };
+
+  typedef boost::shared_ptr<const Script> ScriptPtr;
+
+  MainScriptCache();
+
+  /*
+   * Returns the script for the given inputs, rendering it when it is
+   * not yet in the cache.
+   */
+  ScriptPtr get(Configuration& conf, const std::string& appClass,
+		bool jQuery, bool uglyInternalPaths);
+
+  /*
+   * Returns the script for the given inputs if it is in the cache, or
+   * 0 otherwise.
+   */
+  ScriptPtr find(Configuration& conf, const std::string& appClass,
+		 bool jQuery, bool uglyInternalPaths);
+
+  /*
+   * Returns the session independent URL of a script, relative to the
+   * given deployment path.
+   */
+  static std::string url(const std::string& deployPath,
+			 const std::string& appClass,
+			 bool jQuery, bool uglyInternalPaths,
+			 const Script& script);
+
+  /*
+   * Serves a request for url(). Only scripts that were rendered for a
+   * session are served: any other request gets a 404 response (the
+   * boot script then loads the full session script instead).
+   */
+  void serve(Configuration& conf, WebRequest& request);
+
+private:
+  // guards against an unbounded number of application classes
+  static const unsigned MAX_ENTRIES = 32;
+
+  typedef std::map<std::string, ScriptPtr> ScriptMap;
+  ScriptMap scripts_;
+
+#ifdef WT_THREADED
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  static ScriptPtr render(Configuration& conf, const std::string& appClass,
+			  bool jQuery, bool uglyInternalPaths);
+  static std::string compress(const std::string& text);
+};
+
+}
+
+#endif // MAIN_SCRIPT_CACHE_H_
@@ -12,11 +12,16 @@
 #include <set>
 #include <map>
 
+#include <boost/unordered_map.hpp>
+#include <boost/weak_ptr.hpp>
+
 #include <Wt/WDllDefs.h>
 #include <Wt/WServer>
 #include <Wt/WSocketNotifier>
 
+#include "MainScriptCache.h"
 #include "SocketNotifier.h"
+#include "TimeUtil.h"
 
 #if defined(WT_THREADED) && !defined(WT_TARGET_JAVA)
 #include <boost/thread.hpp>
@@ -127,11 +132,16 @@ public:
 			    const std::string& newSessionId);
   std::string generateNewSessionId(boost::shared_ptr<WebSession> session);
 
+  MainScriptCache& mainScriptCache() { return mainScriptCache_; }
+
 private:
   Configuration& conf_;
   std::string singleSessionId_;
   bool autoExpire_;
   int plainHtmlSessions_, ajaxSessions_;
+
+  // the number of sessions in all shards, see countSessions()
+  int sessionCount_;
   std::string redirectSecret_;
   bool running_;
 
@@ -140,14 +150,86 @@ private:
 #endif // WT_THREADED
   std::set<std::string> uploadProgressUrls_;
 
-  typedef std::map<std::string, boost::shared_ptr<WebSession> > SessionMap;
-  SessionMap sessions_;
+  MainScriptCache mainScriptCache_;
+
+  struct SessionInfo {
+    SessionInfo() : expiryScheduled(false) { }
+
+    boost::shared_ptr<WebSession> session;
+
+    // the time of the session's entry in the expiry queue, if any
+    Time expiry;
+    bool expiryScheduled;
+  };
 
+  typedef boost::unordered_map<std::string, SessionInfo> SessionMap;
+
+  /*
+   * The sessions are spread over a number of shards, on the hash of
+   * their session id, each with its own lock, so that requests for
+   * different sessions rarely contend for the same lock.
+   *
+   * A shard lock may be grabbed before mutex_ and expiryMutex_, but
+   * not the other way around.
+   */
+  struct SessionShard {
 #ifdef WT_THREADED
-  // mutex to protect access to the sessions map and plain/ajax session
-  // counts
+    boost::mutex mutex;
+#endif // WT_THREADED
+    SessionMap sessions;
+  };
+
+  static const int SESSION_SHARDS = 32;
+  SessionShard shards_[SESSION_SHARDS];
+
+  SessionShard& shard(const std::string& sessionId);
+
+  // adds delta to sessionCount_, after adding or removing sessions
+  void countSessions(int delta);
+
+  /*
+   * Sessions are expired using a min-heap on their expiry time. Each
+   * session has (at least) one entry in the heap, at or before its
+   * expireTime(): when an entry turns out to be early, it is
+   * rescheduled. Stale entries (of removed sessions, or which have
+   * been rescheduled) are skipped.
+   */
+  struct ExpiryEntry {
+    ExpiryEntry(const Time& aTime, const boost::shared_ptr<WebSession>& aSession)
+      : time(aTime), session(aSession)
+    { }
+
+    Time time;
+    boost::weak_ptr<WebSession> session;
+
+    // orders the entries for a min-heap
+    bool operator< (const ExpiryEntry& other) const {
+      return time - other.time > 0;
+    }
+  };
+
+  std::vector<ExpiryEntry> expiryQueue_;
+
+  // assumes that you did grab the shard lock
+  void scheduleExpiry(SessionInfo& info, bool force = false);
+  void rescheduleExpiry(const boost::shared_ptr<WebSession>& session);
+
+  // updates the plain/ajax session counts
+  void sessionRemoved(const boost::shared_ptr<WebSession>& session);
+
+#ifdef WT_THREADED
+  // mutex to protect access to the plain/ajax session counts,
+  // singleSessionId_ and running_
   boost::recursive_mutex mutex_;
 
+  // mutex to protect access to the expiry queue
+  boost::mutex expiryMutex_;
+
+  // mutex to protect access to sessionCount_. No other lock is taken
+  // while holding it: sessionCount() is called from within a shard
+  // lock (by WebSession), and thus cannot lock the shards itself.
+  mutable boost::mutex sessionCountMutex_;
+
   SocketNotifier socketNotifier_;
   // mutex to protect access to notifier maps. This cannot be protected
   // by mutex_ as this lock is grabbed while the application lock is
@@ -149,6 +149,7 @@ private:
   std::string headDeclarations() const;
   std::string bodyClassRtl() const;
   std::string sessionUrl() const;
+  std::string publicDeploymentPath() const;
 
   typedef std::set<WWidget *> UpdateMap;
   UpdateMap updateMap_;
@@ -1,6 +1,6 @@
 window.onresize = function() { };
 
-function loadScript(url, callback) {
+function loadScript(url, callback, error) {
   var h = document.getElementsByTagName('head')[0];
   var agent = navigator.userAgent.toLowerCase();
   var re = /firefox\/(\d+)\./;
@@ -12,12 +12,15 @@ function loadScript(url, callback) {
 
     async.onreadystatechange = function() {
       if (async.readyState == 4) {
-	var s = document.createElement('script');
-	s.type = 'text/javascript';
-	s.innerHTML=async.responseText;
-	h.appendChild(s);
-	if (callback)
-	  callback();
+	if (async.status == 200) {
+	  var s = document.createElement('script');
+	  s.type = 'text/javascript';
+	  s.innerHTML=async.responseText;
+	  h.appendChild(s);
+	  if (callback)
+	    callback();
+	} else if (error)
+	  error();
       }
     };
 
@@ -39,6 +42,11 @@ function loadScript(url, callback) {
       }
     }
 
+    if (error)
+      s.onerror = function() {
+	error();
+      };
+
     s.setAttribute('src', url);
     h.appendChild(s);
   }
@@ -264,8 +272,20 @@ _$_$endif_$_();
 
     var allInfo = hashInfo + scaleInfo + htmlHistoryInfo + deployPathInfo;
 _$_$ifnot_SPLIT_SCRIPT_$_();
-    loadScript(selfUrl + allInfo + '&request=script&rand=' + rand(),
-               null);
+    /*
+     * The session independent part of the script can be cached. If it
+     * cannot be loaded, the session script includes it.
+     */
+    loadScript(_$_MAIN_SCRIPT_URL_$_,
+               function() {
+                 loadScript(selfUrl + allInfo
+                            + '&request=script&wtjs=_$_MAIN_SCRIPT_VERSION_$_'
+                            + '&rand=' + rand(), null);
+               },
+               function() {
+                 loadScript(selfUrl + allInfo
+                            + '&request=script&rand=' + rand(), null);
+               });
 _$_$endif_$_();
 _$_$if_SPLIT_SCRIPT_$_();
     /* Ideally, we should be able to omit the sessionid too */
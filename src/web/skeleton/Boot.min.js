@@ -1,10 +1,10 @@
 window.onresize=function(){};
-function loadScript(a,k){var r=document.getElementsByTagName("head")[0],s=/firefox\/(\d+)\./.exec(navigator.userAgent.toLowerCase());if(s&&s[1]>=20){var l=new XMLHttpRequest;l.open("GET",a,true);l.onreadystatechange=function(){if(l.readyState==4){var t=document.createElement("script");t.type="text/javascript";t.innerHTML=l.responseText;r.appendChild(t);k&&k()}};l.send(null)}else{var f=document.createElement("script");if(k)if(f.readyState)f.onreadystatechange=function(){if(f.readyState=="loaded"||
-f.readyState=="complete"){f.onreadystatechange=null;k()}};else f.onload=function(){k()};f.setAttribute("src",a);r.appendChild(f)}}_$_$if_PROGRESS_$_();var delayedClicks=[];
+function loadScript(a,k,e){var r=document.getElementsByTagName("head")[0],s=/firefox\/(\d+)\./.exec(navigator.userAgent.toLowerCase());if(s&&s[1]>=20){var l=new XMLHttpRequest;l.open("GET",a,true);l.onreadystatechange=function(){if(l.readyState==4)if(l.status==200){var t=document.createElement("script");t.type="text/javascript";t.innerHTML=l.responseText;r.appendChild(t);k&&k()}else e&&e()};l.send(null)}else{var f=document.createElement("script");if(k)if(f.readyState)f.onreadystatechange=function(){if(f.readyState=="loaded"||
+f.readyState=="complete"){f.onreadystatechange=null;k()}};else f.onload=function(){k()};if(e)f.onerror=function(){e()};f.setAttribute("src",a);r.appendChild(f)}}_$_$if_PROGRESS_$_();var delayedClicks=[];
 function delayClick(a){delayedClicks.push({bubbles:a.bubbles,cancelable:a.cancelable,detail:a.detail,screenX:a.screenX,screenY:a.screenY,clientX:a.clientX,clientY:a.clientY,ctrlKey:a.ctrlKey,altKey:a.altKey,shiftKey:a.shiftKey,metaKey:a.metaKey,button:a.button,targetId:(a.target||a.srcElement).id});a.stopPropagation&&a.stopPropagation();a.preventDefault&&a.preventDefault();a.cancelBubble=true;return a.returnValue=false}_$_$endif_$_();
 (function(){function a(){function k(){return Math.round(Math.random()*1E6)+_$_RANDOMSEED_$_}function r(c){if(g.location.replace)g.location.replace(c);else g.location.href=c}function s(){var c=m.getElementById("Wt-form");if(c!=null)c.style.visibility="hidden";else setTimeout(s,10)}function l(){var c=window.location.search;if(c.length>1&&c.charAt(0)=="?")c=c.substr(1);return c.split("&")}function f(c){var q,i,e,n;i=l();q=0;for(n=i.length;q<n;q++){e=i[q].split("=");if(e.length>=2)if(e[0]===c)return unescape(e[1])}return null}
 function t(c,q){var i,e,n,x,y=false;e=l();i=0;for(x=e.length;i<x;i++){n=e[i].split("=");if(n.length>=2)if(n[0]===c){n[1]=escape(q);e[i]=n.join("=");y=true;break}}y||e.push(c+"="+escape(q));return"?"+e.join("&")+window.location.hash}var m=document,g=window;try{m.execCommand("BackgroundImageCache",false,true)}catch(A){}g.opera&&g.opera.setOverrideHistoryNavigationMode("compatible");var h=_$_PATH_INFO_$_,d=g.location.pathname;g.opera||(d=decodeURIComponent(d));if(h.length>0){var b=d.lastIndexOf(h);if(b!=
 -1)d=d.substr(0,b)+d.substr(b+h.length)}h="&deployPath="+encodeURIComponent(d);var o=g.XMLHttpRequest||g.ActiveXObject,j=_$_RELOAD_IS_NEWSESSION_$_;_$_$if_COOKIE_CHECKS_$_();m.cookie="jscookietest=valid";j=j||_$_USE_COOKIES_$_&&m.cookie.indexOf("jscookietest=valid")!=-1;m.cookie="jscookietest=valid;expires=Thu, 01 Jan 1970 00:00:00 GMT";d=new Date;d.setTime(d.getTime()+1E3);m.cookie="WtTestCookie=ok;path=/;expires="+d.toGMTString();_$_$endif_$_();b=g.location.hash;if(b.length>0)b=b.substr(1);var p=
 b.indexOf("?");if(p!=-1)b=b.substr(0,p);p=navigator.userAgent.toLowerCase();if(p.indexOf("gecko")==-1||p.indexOf("webkit")!=-1)b=unescape(b);p="";if(screen.deviceXDPI!=screen.logicalXDPI)p="&scale="+screen.deviceXDPI/screen.logicalXDPI;var u=_$_SELF_URL_$_+"&sid="+_$_SCRIPT_ID_$_,v=!!(window.history&&window.history.pushState),z=v?"&htmlHistory=true":"";if(j=!j||!o)if(f("wtd")==="_$_SESSION_ID_$_")j=false;if(j)if(v)r(t("wtd","_$_SESSION_ID_$_"));else{h=b.length>1&&b.charAt(0)=="/"?b:_$_INTERNAL_PATH_$_;
 if(h.length>0)u+="#"+h;r(u)}else if(o){o=_$_AJAX_CANONICAL_URL_$_;j="";if(!v&&o.length>1){_$_$if_HYBRID_$_();h="WtInternalPath="+escape(_$_INTERNAL_PATH_$_)+";path=/;expires="+d.toGMTString();m.cookie=h;_$_$endif_$_();if(o.charAt(0)=="#")o="../"+o;r(o)}else{if(b.length>1&&b.charAt(0)=="/"){j="&_="+encodeURIComponent(b);_$_$if_HYBRID_$_();b!=_$_INTERNAL_PATH_$_&&setTimeout(s,10);_$_$endif_$_()}_$_$if_PROGRESS_$_();d=m.body;d.addEventListener?d.addEventListener("click",delayClick,true):d.attachEvent("onclick",
-delayClick);_$_$endif_$_();var w=j+p+z+h;_$_$ifnot_SPLIT_SCRIPT_$_();loadScript(u+w+"&request=script&rand="+k(),null);_$_$endif_$_();_$_$if_SPLIT_SCRIPT_$_();loadScript(u+w+"&request=script&skeleton=true",function(){loadScript(u+w+"&request=script&rand="+k(),null)});_$_$endif_$_()}}}setTimeout(a,0)})();
+delayClick);_$_$endif_$_();var w=j+p+z+h;_$_$ifnot_SPLIT_SCRIPT_$_();loadScript(_$_MAIN_SCRIPT_URL_$_,function(){loadScript(u+w+"&request=script&wtjs=_$_MAIN_SCRIPT_VERSION_$_&rand="+k(),null)},function(){loadScript(u+w+"&request=script&rand="+k(),null)});_$_$endif_$_();_$_$if_SPLIT_SCRIPT_$_();loadScript(u+w+"&request=script&skeleton=true",function(){loadScript(u+w+"&request=script&rand="+k(),null)});_$_$endif_$_()}}}setTimeout(a,0)})();
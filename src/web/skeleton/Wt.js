@@ -1917,7 +1917,7 @@ var WT = _$_WT_CLASS_$_;
 var downX = 0;
 var downY = 0;
 
-var deployUrl = _$_DEPLOY_PATH_$_;
+var deployUrl = null;
 
 function saveDownPos(e) {
   var coords = WT.pageCoordinates(e);
@@ -2543,9 +2543,20 @@ function setSessionUrl(url) {
     comm.setUrl(url);
 }
 
-setSessionUrl(_$_SESSION_URL_$_);
+var comm = null;
 
-var comm = WT.initAjaxComm(sessionUrl, handleResponse);
+/*
+ * Session specific values, passed by the script preamble
+ */
+function init(config) {
+  deployUrl = config.deployPath;
+  setSessionUrl(config.sessionUrl);
+  ackUpdateId = config.ackUpdateId;
+  scriptParams = config.params;
+
+  if (!comm)
+    comm = WT.initAjaxComm(sessionUrl, handleResponse);
+}
 
 function doPollTimeout() {
   responsePending.abort();
@@ -2723,7 +2734,7 @@ _$_$endif_$_();
   }
 }
 
-var ackUpdateId = _$_ACK_UPDATE_ID_$_, ackPuzzle = null;
+var ackUpdateId = null, ackPuzzle = null, scriptParams = '';
 function responseReceived(updateId, puzzle) {
   ackPuzzle = puzzle;
   ackUpdateId = updateId;
@@ -2795,9 +2806,8 @@ function sendUpdate() {
     data.result += '&ackPuzzle=' + encodeURIComponent(solution);
   }
 
-  var params = "_$_PARAMS_$_";
-  if (params.length > 0)
-    data.result += '&' + params;
+  if (scriptParams.length > 0)
+    data.result += '&' + scriptParams;
 
   if (websocket.socket != null && websocket.socket.readyState == 1) {
     responsePending = null;
@@ -3109,6 +3119,7 @@ function setCloseMessage(m)
 };
 
 this._p_ = {
+  init : init,
   ieAlternative : ieAlternative,
   loadScript : loadScript,
   onJsLoad : onJsLoad,
@@ -81,13 +81,13 @@ n)}else h()}}function ga(c){ea=c.indexOf("://")!=-1||c[0]=="/"?c:u+c;qa&&qa.setU
 "undefined"&&typeof window.MozWebSocket==="undefined")z.state=2;else{var c=z.socket;if(c==null||c.readyState>1)if(c!=null&&z.state==0)z.state=2;else{function e(){++z.reconnectTries;var j=Math.min(12E4,Math.exp(z.reconnectTries)*500);setTimeout(function(){b()},j)}var f;if(ea.indexOf("://")!=-1)f="ws"+ea.substr(4);else{f=ea.substr(ea.indexOf("?"));f="ws"+location.protocol.substr(4)+"//"+location.host+u+f}f+="&request=ws";z.socket=typeof window.WebSocket!=="undefined"?(c=new WebSocket(f)):(c=new MozWebSocket(f));
 z.keepAlive&&clearInterval(z.keepAlive);z.keepAlive=null;c.onmessage=function(j){z.reconnectTries=0;z.state=1;F(0,j.data,null)};c.onerror=function(){if(z.reconnectTries==3&&z.state==0)z.state=2;e()};c.onclose=function(){if(z.reconnectTries==3&&z.state==0)z.state=2;e()};c.onopen=function(){c.send("&signal=ping");z.keepAlive&&clearInterval(z.keepAlive);z.keepAlive=setInterval(function(){if(c.readyState==1)c.send("&signal=ping");else{clearInterval(z.keepAlive);z.keepAlive=null}},_$_SERVER_PUSH_TIMEOUT_$_)}}if(c.readyState==
 1){h();return}}_$_$endif_$_();if(N!=null&&W!=null){clearTimeout(W);N.abort();N=null}if(N==null)if(da==null){da=setTimeout(function(){h()},o.updateDelay);wa=(new Date).getTime()}else if(la){clearTimeout(da);h()}else if((new Date).getTime()-wa>o.updateDelay){clearTimeout(da);h()}}}function d(c,e){sa=e;ta=c;qa.responseReceived(c)}function i(c){xa=c}function h(){if(C!=window._$_APP_CLASS_$_)T();else if(!N){da=null;if(R){if(!ya){if(confirm("The application was quited, do you want to restart?"))document.location=
-document.location;ya=true}}else{var c,e,f;if(H.length>0){c=g();e=c.feedback?setTimeout(V,_$_INDICATOR_TIMEOUT_$_):null;f=false}else{c={result:"&signal=poll"};e=null;f=true}c.result+="&ackId="+ta+"&pageId="+xa;if(sa){var j="",n=$("#"+sa).get(0);if(n)for(n=n.parentNode;!o.hasTag(n,"BODY");n=n.parentNode)if(n.id){if(j!="")j+=",";j+=n.id}c.result+="&ackPuzzle="+encodeURIComponent(j)}c.result+="&_$_PARAMS_$_";if(z.socket!=null&&z.socket.readyState==1){N=null;e!=null&&clearTimeout(e);f||z.socket.send(c.result)}else{N=
+document.location;ya=true}}else{var c,e,f;if(H.length>0){c=g();e=c.feedback?setTimeout(V,_$_INDICATOR_TIMEOUT_$_):null;f=false}else{c={result:"&signal=poll"};e=null;f=true}c.result+="&ackId="+ta+"&pageId="+xa;if(sa){var j="",n=$("#"+sa).get(0);if(n)for(n=n.parentNode;!o.hasTag(n,"BODY");n=n.parentNode)if(n.id){if(j!="")j+=",";j+=n.id}c.result+="&ackPuzzle="+encodeURIComponent(j)}if(Ya.length>0)c.result+="&"+Ya;if(z.socket!=null&&z.socket.readyState==1){N=null;e!=null&&clearTimeout(e);f||z.socket.send(c.result)}else{N=
 qa.sendUpdate("request=jsupdate"+c.result,e,ta,-1);W=f?setTimeout(S,_$_SERVER_PUSH_TIMEOUT_$_):null}}}}function l(c,e,f){if(e==-1)e=c.offsetWidth;if(f==-1)f=c.offsetHeight;if(typeof c.wtWidth==="undefined"||c.wtWidth!=e||typeof c.wtHeight==="undefined"||c.wtHeight!=f){c.wtWidth=e;c.wtHeight=f;e>=0&&f>=0&&k(c,"resized",e,f)}}function k(c,e){var f={},j=H.length;f.signal="user";f.id=typeof c==="string"?c:c==C?"app":c.id;if(typeof e==="object"){f.name=e.name;f.object=e.eventObject;f.event=e.event}else{f.name=
 e;f.object=f.event=null}f.args=[];for(var n=2;n<arguments.length;++n){var m=arguments[n];m=m===false?0:m===true?1:m.toDateString?m.toDateString():m;f.args[n-2]=m}f.feedback=true;H[j]=ia(f,j);b()}function q(c,e,f){var j=function(){var m=o.getElement(c);if(m){if(f)m.timer=setTimeout(m.tm,e);else{m.timer=null;m.tm=null}m.onclick&&m.onclick()}},n=o.getElement(c);n.timer&&clearTimeout(n.timer);n.timer=setTimeout(j,e);n.tm=j}function t(c,e){setTimeout(function(){if(fa[c]===true){pa=false;e()}else fa[c]=
 e},20);pa=true}function s(c){if(fa[c]!==true){if(typeof fa[c]!=="undefined"){pa=false;fa[c]()}fa[c]=true}}function x(c,e,f){function j(){var A=f===undefined?o.isIE?1:2:f;if(A>1)x(c,e,A-1);else{alert("Fatal error: failed loading "+c);T()}}var n=false;if(e!="")try{n=!eval("typeof "+e+" === 'undefined'")}catch(m){n=false}if(n)s(c);else{var v=document.createElement("script");v.setAttribute("src",c);v.onload=function(){s(c)};v.onerror=j;v.onreadystatechange=function(){var A=v.readyState;if(A=="loaded")o.isOpera||
 o.isIE?s(c):j();else A=="complete"&&s(c)};document.getElementsByTagName("head")[0].appendChild(v)}}function w(c,e){this.callback=e;this.work=c.length;this.images=[];if(c.length==0)e(this.images);else for(e=0;e<c.length;e++)this.preload(c[e])}function y(c,e){this.callback=e;this.work=c.length;this.arrayBuffers=[];if(c.length==0)e(this.arrayBuffers);else for(e=0;e<c.length;e++)this.preload(c[e],e)}function r(c){B=c;o.history.register(c,L)}function E(c){if(c.ieAlternativeExecuted)return"0";C.emit(c.parentNode,
-"IeAltnernative");c.style.width="";c.ieAlternativeExecuted=true;return"0"}function M(c){window.onbeforeunload=c&&c!=""?function(e){if(e=e||window.event)e.returnValue=c;return c}:null}var C=this,o=_$_WT_CLASS_$_,U=0,p=0,u=_$_DEPLOY_PATH_$_,B=null,J={object:null,sourceId:null,mimeType:null,dropOffsetX:null,dragOffsetY:null,dropTarget:null,objectPrevStyle:null,xy:null},O=[],G=[],H=[],ea,R=false,ya=false,ua=false,N=null,W=null,ka=null,la=0,va=false,da=null,oa=null,z={state:0,socket:null,keepAlive:null,
-reconnectTries:0};ga(_$_SESSION_URL_$_);var qa=o.initAjaxComm(ea,F),ra=false,wa,ta=_$_ACK_UPDATE_ID_$_,sa=null,xa=0,fa={},pa=false;w.prototype.preload=function(c){var e=new Image;this.images.push(e);e.onload=w.prototype.onload;e.onerror=w.prototype.onload;e.onabort=w.prototype.onload;e.imagePreloader=this;e.src=c};w.prototype.onload=function(){var c=this.imagePreloader;--c.work==0&&c.callback(c.images)};y.prototype.preload=function(c,e){var f=new XMLHttpRequest;f.open("GET",c,true);f.responseType=
-"arraybuffer";f.arrayBuffers=this.arrayBuffers;f.preloader=this;f.index=e;f.uri=c;f.onload=function(){console.log("XHR load buffer "+this.index+" from uri "+this.uri);this.arrayBuffers[this.index]=this.response;this.preloader.afterLoad()};f.onerror=y.prototype.afterload;f.onabort=y.prototype.afterload;f.send()};y.prototype.afterLoad=function(){--this.work==0&&this.callback(this.arrayBuffers)};window.onunload=function(){if(!R){C.emit(C,"Wt-unload");b();h()}};this._p_={ieAlternative:E,loadScript:x,
+"IeAltnernative");c.style.width="";c.ieAlternativeExecuted=true;return"0"}function M(c){window.onbeforeunload=c&&c!=""?function(e){if(e=e||window.event)e.returnValue=c;return c}:null}var C=this,o=_$_WT_CLASS_$_,U=0,p=0,u=null,B=null,J={object:null,sourceId:null,mimeType:null,dropOffsetX:null,dragOffsetY:null,dropTarget:null,objectPrevStyle:null,xy:null},O=[],G=[],H=[],ea,R=false,ya=false,ua=false,N=null,W=null,ka=null,la=0,va=false,da=null,oa=null,z={state:0,socket:null,keepAlive:null,
+reconnectTries:0};var qa=null,ra=false,wa,ta=null,sa=null,Ya="",xa=0,fa={},pa=false;w.prototype.preload=function(c){var e=new Image;this.images.push(e);e.onload=w.prototype.onload;e.onerror=w.prototype.onload;e.onabort=w.prototype.onload;e.imagePreloader=this;e.src=c};w.prototype.onload=function(){var c=this.imagePreloader;--c.work==0&&c.callback(c.images)};y.prototype.preload=function(c,e){var f=new XMLHttpRequest;f.open("GET",c,true);f.responseType=
+"arraybuffer";f.arrayBuffers=this.arrayBuffers;f.preloader=this;f.index=e;f.uri=c;f.onload=function(){console.log("XHR load buffer "+this.index+" from uri "+this.uri);this.arrayBuffers[this.index]=this.response;this.preloader.afterLoad()};f.onerror=y.prototype.afterload;f.onabort=y.prototype.afterload;f.send()};y.prototype.afterLoad=function(){--this.work==0&&this.callback(this.arrayBuffers)};window.onunload=function(){if(!R){C.emit(C,"Wt-unload");b();h()}};this._p_={init:function(c){u=c.deployPath;ga(c.sessionUrl);ta=c.ackUpdateId;Ya=c.params;if(!qa)qa=o.initAjaxComm(ea,F)},ieAlternative:E,loadScript:x,
 onJsLoad:t,setTitle:Q,update:a,quit:T,setSessionUrl:ga,setFormObjects:function(c){O=c},saveDownPos:K,addTimerEvent:q,load:aa,setServerPush:ba,dragStart:P,dragDrag:Y,dragEnd:ma,capture:o.capture,enableInternalPaths:r,onHashChange:L,setHash:D,ImagePreloader:w,ArrayBufferPreloader:y,doAutoJavaScript:ja,autoJavaScript:function(){},response:d,setPage:i,setCloseMessage:M,propagateSize:l};this.WT=_$_WT_CLASS_$_;this.emit=k});window._$_APP_CLASS_$_SignalEmit=_$_APP_CLASS_$_.emit;
 window._$_APP_CLASS_$_OnLoad=function(){_$_APP_CLASS_$_._p_.load()};